@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Measures plugin record lookups in the binary plugin catalog (catalog.bin).
+Generates synthetic plugin descriptors, builds their catalog with BuildHTMLFromJSONFiles.build_catalog,
+serves it from a local HTTP server that supports range requests, and fetches records with the
+FetchPluginRecord.py reference client. Reports the requests and bytes transferred per lookup, and
+fails if a lookup returns the wrong record.
+"""
+
+import sys
+import argparse
+import http.server
+import random
+import re
+import tempfile
+import threading
+from pathlib import Path
+
+from BuildHTMLFromJSONFiles import build_catalog
+from FetchPluginRecord import DEFAULT_INITIAL_BYTES, RangeReader, fetch_plugin_record
+from PluginCatalog import CATALOG_FILE
+
+
+class RangeRequestHandler(http.server.SimpleHTTPRequestHandler):
+    """Serves files, honoring single "bytes=first-last" Range headers."""
+
+    def do_GET(self):
+        match = re.fullmatch(r"bytes=(\d+)-(\d+)", self.headers.get("Range", ""))
+        if match is None:
+            super().do_GET()
+            return
+        try:
+            data = Path(self.translate_path(self.path)).read_bytes()
+        except OSError:
+            self.send_error(404)
+            return
+        first, last = int(match[1]), min(int(match[2]), len(data) - 1)
+        if first > last:
+            self.send_error(416)
+            return
+        self.send_response(206)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Range", f"bytes {first}-{last}/{len(data)}")
+        self.send_header("Content-Length", str(last - first + 1))
+        self.end_headers()
+        self.wfile.write(data[first:last + 1])
+
+    def log_message(self, format, *args):
+        pass
+
+
+def generate_plugins(count: int, rng: random.Random) -> list[dict]:
+    """Generate count synthetic plugin descriptors with unique names, some of them non-ASCII."""
+    plugins = []
+    for i in range(count):
+        name = f"plugin_{rng.randrange(10**9):09d}_{i}"
+        if i % 10 == 0:
+            name = f"plügin_设备_{i}"
+        plugins.append({
+            "SchemaVersion": 1,
+            "Company": f"Company {i % 997}",
+            "Name": name,
+            "Description": f"Synthetic plugin {i}, generated to measure catalog lookups.",
+            "SiteURL": f"https://example.com/plugins/{i}",
+            "Architectures": ["x64", "aarch64"],
+            "OperatingSystems": ["Linux"],
+        })
+    return plugins
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Measure range-request lookups in the binary plugin catalog.")
+    parser.add_argument("-n", "--plugins", default=100_000, type=int, help="Number of synthetic plugins")
+    parser.add_argument("-l", "--lookups", default=20, type=int, help="Number of lookups to measure (at least 1)")
+    parser.add_argument(
+        "--initial-bytes",
+        default=DEFAULT_INITIAL_BYTES,
+        type=int,
+        help="Size of the client's first range request",
+    )
+    parser.add_argument("--seed", default=0, type=int, help="Random seed")
+
+    args = parser.parse_args()
+    if args.plugins < 1 or args.lookups < 1:
+        print("Error: --plugins and --lookups must be at least 1", file=sys.stderr)
+        return 1
+    rng = random.Random(args.seed)
+    plugins = generate_plugins(args.plugins, rng)
+
+    with tempfile.TemporaryDirectory() as serve_dir:
+        catalog_path = Path(serve_dir) / CATALOG_FILE
+        build_catalog(plugins, catalog_path)
+        catalog_size = catalog_path.stat().st_size
+
+        def handler(*handler_args, **kwargs):
+            return RangeRequestHandler(*handler_args, directory=serve_dir, **kwargs)
+
+        server = http.server.ThreadingHTTPServer(("127.0.0.1", 0), handler)
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        url = f"http://127.0.0.1:{server.server_port}/{CATALOG_FILE}"
+        try:
+            requests = bytes_transferred = 0
+            # The first plugin has a non-ASCII name, so every run covers one such lookup.
+            lookups = [plugins[0]] + [rng.choice(plugins) for _ in range(args.lookups - 1)]
+            for expected in lookups:
+                reader = RangeReader(url)
+                record = fetch_plugin_record(reader, expected["Name"], args.initial_bytes)
+                if record != expected:
+                    print(f"Error: wrong record for plugin {expected['Name']!r}", file=sys.stderr)
+                    return 1
+                requests += reader.requests
+                bytes_transferred += reader.bytes_transferred
+
+            reader = RangeReader(url)
+            if fetch_plugin_record(reader, "no such plugin", args.initial_bytes) is not None:
+                print("Error: lookup of a missing plugin returned a record", file=sys.stderr)
+                return 1
+        finally:
+            server.shutdown()
+            server.server_close()
+
+    print(f"Catalog: {args.plugins} plugin(s), {catalog_size} byte(s)")
+    print(f"Per lookup ({len(lookups)} lookup(s)): {requests / len(lookups):.2f} request(s), "
+          f"{bytes_transferred / len(lookups):.0f} byte(s) transferred")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -6,14 +6,41 @@ parses the JSON files to create an HTML site listing all plugins.
 
 import sys
 import argparse
+import hashlib
 import json
+import math
 from pathlib import Path
 
+from PluginCatalog import CATALOG_FILE, CATALOG_HEADER, CATALOG_INDEX_ENTRY, CATALOG_MAGIC, CATALOG_VERSION
+
 
 REQUIRED_KEYS = ("SchemaVersion", "Name", "Description", "Company", "SiteURL", "Architectures", "OperatingSystems")
 VALID_ARCHITECTURES = {"x64", "aarch64"}
 VALID_OPERATING_SYSTEMS = {"Windows", "Linux"}
 
+BENCHMARKS_DIR_NAME = "Benchmarks"
+BENCHMARK_REQUIRED_KEYS = ("SchemaVersion", "Name", "Results")
+# Metric key -> (column title, unit) of the optional numeric benchmark metrics.
+BENCHMARK_METRICS = {
+    "OverheadPercent": ("Overhead", "%"),
+    "SampleLatencyUs": ("Per-sample latency", "us"),
+}
+# Bump whenever the rendered benchmark HTML or its validation changes, to invalidate cached fragments.
+BENCHMARK_RENDER_VERSION = 6
+
+# Extra pages written next to the plugins list.
+OVERHEAD_PAGE = "overhead.html"
+COMPATIBILITY_PAGE = "compatibility.html"
+
+
+def is_number(v) -> bool:
+    """Whether v is a finite JSON number. Python's json module also accepts NaN and Infinity."""
+    return isinstance(v, (int, float)) and not isinstance(v, bool) and math.isfinite(v)
+
+
+def is_sampling_rate(v) -> bool:
+    return is_number(v) and v > 0
+
 
 def validate_plugin_json(data: dict) -> list[str]:
     """
@@ -72,6 +99,57 @@ def validate_plugin_json(data: dict) -> list[str]:
         if key in data and data[key] is not None and not isinstance(data[key], str):
             errors.append(f"{key!r} must be a string")
 
+    if "Performance" in data:
+        perf = data["Performance"]
+        if not isinstance(perf, dict):
+            errors.append("Performance must be an object")
+        else:
+            if not is_sampling_rate(perf.get("SamplingRateHz")):
+                errors.append("Performance.SamplingRateHz must be a positive number")
+            for key in BENCHMARK_METRICS:
+                if key in perf and not is_number(perf[key]):
+                    errors.append(f"Performance.{key} must be a finite number")
+
+    return errors
+
+
+def validate_benchmark_json(data: dict) -> list[str]:
+    """
+    Validate plugin benchmark results format. Returns a list of error messages (empty if valid).
+    """
+    errors = []
+    if not isinstance(data, dict):
+        return [f"root must be a JSON object"]
+
+    for key in BENCHMARK_REQUIRED_KEYS:
+        if key not in data:
+            errors.append(f"missing required key: {key!r}")
+
+    if "SchemaVersion" in data:
+        v = data["SchemaVersion"]
+        if not isinstance(v, int) or v != 1:
+            errors.append("SchemaVersion must be the integer 1")
+
+    if "Name" in data and not isinstance(data["Name"], str):
+        errors.append("'Name' must be a string")
+
+    if "Results" in data:
+        results = data["Results"]
+        if not isinstance(results, list):
+            errors.append("Results must be an array")
+        else:
+            for i, entry in enumerate(results):
+                if not isinstance(entry, dict):
+                    errors.append(f"Results[{i}] must be an object")
+                    continue
+                if not isinstance(entry.get("PluginVersion"), str):
+                    errors.append(f"Results[{i}].PluginVersion must be a string")
+                if not is_sampling_rate(entry.get("SamplingRateHz")):
+                    errors.append(f"Results[{i}].SamplingRateHz must be a positive number")
+                for key in BENCHMARK_METRICS:
+                    if key in entry and not is_number(entry[key]):
+                        errors.append(f"Results[{i}].{key} must be a finite number")
+
     return errors
 
 
@@ -103,6 +181,87 @@ def collect_plugins(input_dir: Path) -> list[dict]:
     return plugins
 
 
+def latest_version_results(results: list[dict]) -> list[dict]:
+    """
+    Return the results of the latest plugin version (the version of the last result), one per sampling rate,
+    sorted by rate. When a rate is listed more than once for that version, the last such result is used.
+    """
+    latest_version = results[-1]["PluginVersion"]
+    by_rate = {e["SamplingRateHz"]: e for e in results if e["PluginVersion"] == latest_version}
+    return [by_rate[rate] for rate in sorted(by_rate)]
+
+
+def render_benchmark_entry(path: Path, raw: bytes) -> dict | None:
+    """Parse, validate and render the results file read from path. Returns None on failure."""
+    try:
+        data = json.loads(raw)
+    except (UnicodeDecodeError, json.JSONDecodeError) as e:
+        print(f"Error: failed to parse {path}: {e}", file=sys.stderr)
+        return None
+    validation_errors = validate_benchmark_json(data)
+    if validation_errors:
+        print(f"Error: invalid format in {path}:", file=sys.stderr)
+        for err in validation_errors:
+            print(f"  - {err}", file=sys.stderr)
+        return None
+    results = data["Results"]
+    return {
+        "Name": data["Name"],
+        "Html": render_benchmarks(results) if results else "",
+        "Latest": latest_version_results(results) if results else [],
+    }
+
+
+def collect_benchmarks(input_dir: Path, cache_dir: Path | None) -> dict[str, dict]:
+    """
+    Collect every valid results file under input_dir/Benchmarks, keyed by plugin name, as its rendered
+    HTML ("Html") and the results of its latest version ("Latest", see latest_version_results). Entries are cached in cache_dir by hash of the results file.
+    When several files have the same plugin name, the first file in name order is used.
+    Cache entries not used by this run are removed.
+    """
+    benchmarks = {}
+    used_cache_paths = set()
+    bench_dir = input_dir / BENCHMARKS_DIR_NAME
+    for path in sorted(bench_dir.glob("*.json")):
+        try:
+            raw = path.read_bytes()
+        except OSError as e:
+            print(f"Error: failed to read {path}: {e}", file=sys.stderr)
+            continue
+        digest = hashlib.sha256(raw + f"/v{BENCHMARK_RENDER_VERSION}".encode()).hexdigest()
+        cache_path = cache_dir / f"{digest}.json" if cache_dir is not None else None
+        used_cache_paths.add(cache_path)
+        entry = None
+        if cache_path is not None and cache_path.is_file():
+            try:
+                entry = json.loads(cache_path.read_text(encoding="utf-8"))
+            except (OSError, json.JSONDecodeError):
+                pass
+            if not isinstance(entry, dict) or not isinstance(entry.get("Name"), str):
+                entry = None  # Corrupt cache entry, render again below.
+        if entry is None:
+            entry = render_benchmark_entry(path, raw)
+            if entry is None:
+                continue
+            if cache_path is not None:
+                cache_dir.mkdir(parents=True, exist_ok=True)
+                cache_path.write_text(json.dumps(entry), encoding="utf-8")
+
+        if entry["Name"] in benchmarks:
+            print(f"Warning: duplicate benchmark results for plugin {entry['Name']!r} in {path} are ignored", file=sys.stderr)
+            continue
+        benchmarks[entry["Name"]] = entry
+
+    if cache_dir is not None:
+        # Entries are keyed by content digest, so edited results files and render version bumps leave orphans.
+        for stale_path in set(cache_dir.glob("*.json")) - used_cache_paths:
+            try:
+                stale_path.unlink()
+            except OSError as e:
+                print(f"Warning: failed to remove stale cache entry {stale_path}: {e}", file=sys.stderr)
+    return benchmarks
+
+
 def escape(s: str) -> str:
     """Escape HTML special characters."""
     return (
@@ -113,8 +272,281 @@ def escape(s: str) -> str:
     )
 
 
-def build_html(plugins: list[dict], output_file_path: Path) -> None:
-    """Generate an HTML page listing all plugins and write it to output_file_path."""
+def format_number(v: float) -> str:
+    """Format a metric with 3 significant digits, without switching to scientific notation at 1000 and above."""
+    rounded = f"{v:.3g}"
+    # Values that round to 1000 or more, e.g. 999.6, are where .3g switches to scientific notation.
+    return rounded if abs(float(rounded)) < 1000 else f"{v:,.0f}"
+
+
+def format_rate(hz: float) -> str:
+    return f"{int(hz)} Hz" if float(hz).is_integer() else f"{hz:g} Hz"
+
+
+def render_sparkline(values: list[float], label: str) -> str:
+    """Render values, oldest first, as an inline SVG sparkline."""
+    width, height, pad = 120, 24, 2
+    lo, hi = min(values), max(values)
+    span = (hi - lo) or 1.0
+    step = (width - 2 * pad) / max(len(values) - 1, 1)
+    points = [
+        (pad + i * step, height - pad - (v - lo) / span * (height - 2 * pad))
+        for i, v in enumerate(values)
+    ]
+    last_x, last_y = points[-1]
+    polyline = ""
+    if len(points) > 1:
+        coords = " ".join(f"{x:.1f},{y:.1f}" for x, y in points)
+        polyline = f'<polyline points="{coords}" fill="none" stroke="#76b900" stroke-width="1.5" />'
+    return (
+        f'<svg class="sparkline" width="{width}" height="{height}" viewBox="0 0 {width} {height}" role="img">'
+        f"<title>{escape(label)}</title>{polyline}"
+        f'<circle cx="{last_x:.1f}" cy="{last_y:.1f}" r="2" fill="#1a1a1a" /></svg>'
+    )
+
+
+def render_benchmarks(results: list[dict]) -> str:
+    """
+    Render benchmark results, listed oldest first, as a table with one row per sampling rate.
+    Each metric shows its latest value next to a sparkline of its history at that rate.
+    """
+    by_rate = {}
+    for entry in results:
+        by_rate.setdefault(entry["SamplingRateHz"], []).append(entry)
+
+    header_cells = "".join(f"<th>{escape(title)}</th>" for title, _ in BENCHMARK_METRICS.values())
+    rows = []
+    for rate in sorted(by_rate):
+        cells = []
+        for key, (title, unit) in BENCHMARK_METRICS.items():
+            history = [(e["PluginVersion"], e[key]) for e in by_rate[rate] if key in e]
+            if not history:
+                cells.append("<td>-</td>")
+                continue
+            values = [v for _, v in history]
+            label = f"{title} at {format_rate(rate)}, plugin versions {history[0][0]} to {history[-1][0]}"
+            cells.append(
+                f"<td>{render_sparkline(values, label)} {format_number(values[-1])} {unit}"
+                f' <span class="bench-version">({escape(history[-1][0])})</span></td>'
+            )
+        rows.append(f"<tr><td>{format_rate(rate)}</td>{''.join(cells)}</tr>")
+
+    history_rows = []
+    for entry in reversed(results):
+        cells = "".join(
+            f"<td>{format_number(entry[key]) + ' ' + unit if key in entry else '-'}</td>"
+            for key, (_, unit) in BENCHMARK_METRICS.items()
+        )
+        history_rows.append(
+            f"<tr><td>{escape(entry['PluginVersion'])}</td><td>{format_rate(entry['SamplingRateHz'])}</td>{cells}</tr>"
+        )
+
+    return f"""<table class="bench-table">
+                    <tr><th>Sampling rate</th>{header_cells}</tr>
+                    {"".join(rows)}
+                </table>
+                <details>
+                    <summary>History</summary>
+                    <table class="bench-table">
+                        <tr><th>Plugin version</th><th>Sampling rate</th>{header_cells}</tr>
+                        {"".join(history_rows)}
+                    </table>
+                </details>"""
+
+
+def parse_version(version: str) -> tuple:
+    """Split a version string such as "2024.1.1" into a tuple that orders numerically."""
+    return tuple(int(part) if part.isdigit() else 0 for part in version.split("."))
+
+
+def performance_by_rate(p: dict, benchmarks: dict[str, dict]) -> dict[float, dict]:
+    """
+    Return the plugin's performance figures for the comparison page, keyed by sampling rate: the benchmark
+    results of its latest version when published, otherwise the plugin's declared "Performance" object, if any.
+    """
+    bench = benchmarks.get(p.get("Name"))
+    if bench is not None and bench.get("Latest"):
+        return {e["SamplingRateHz"]: dict(e, Source=f"Measured ({e['PluginVersion']})") for e in bench["Latest"]}
+    declared = p.get("Performance")
+    if declared:
+        return {declared["SamplingRateHz"]: dict(declared, Source="Declared")}
+    return {}
+
+
+def comparison_rate(figures: list[dict[float, dict]]) -> float | None:
+    """Return the sampling rate with figures for the most plugins, the lowest such rate on ties."""
+    counts = {}
+    for by_rate in figures:
+        for rate in by_rate:
+            counts[rate] = counts.get(rate, 0) + 1
+    if not counts:
+        return None
+    return min(counts, key=lambda rate: (-counts[rate], rate))
+
+
+def render_overhead_table(plugins: list[dict], benchmarks: dict[str, dict]) -> str:
+    """
+    Render the cross-plugin overhead comparison, initially sorted by plugin name. All plugins are compared
+    at a single sampling rate (see comparison_rate), so that the figures of different rows are comparable.
+    """
+    figures = [performance_by_rate(p, benchmarks) for p in plugins]
+    rate = comparison_rate(figures)
+    if rate is None:
+        intro = "No plugin published benchmark results or declared its overhead."
+    else:
+        intro = (
+            f"All plugins are compared at {format_rate(rate)}, the sampling rate with figures for the most plugins. "
+            "Figures are taken from the plugin's published benchmark results for its latest plugin version. "
+            "When no benchmark results were published, the figures declared by the plugin are shown. "
+            "Plugins without figures at this rate show \"-\". Click a column header to sort."
+        )
+    columns = ["Plugin", "Company"] + [title for title, _ in BENCHMARK_METRICS.values()] + ["Source"]
+    header = "".join(f'<th data-col="{i}">{escape(c)}</th>' for i, c in enumerate(columns))
+    rows = []
+    for i, p in sorted(enumerate(plugins), key=lambda ip: ip[1]["Name"].lower()):
+        perf = figures[i].get(rate, {})
+        # data-value holds the sort key of numeric cells, so that "-" sorts after every number.
+        cells = [
+            f'<td><a href="index.html#plugin-{i}">{escape(p["Name"])}</a></td>',
+            f"<td>{escape(p['Company'])}</td>",
+        ]
+        for key, (_, unit) in BENCHMARK_METRICS.items():
+            v = perf.get(key)
+            cells.append(f'<td data-value="{v}">{format_number(v)} {unit}</td>' if v is not None else "<td>-</td>")
+        cells.append(f"<td>{escape(perf.get('Source', '-'))}</td>")
+        rows.append(f"<tr>{''.join(cells)}</tr>")
+    body = "\n        ".join(rows)
+    return f"""<p>{escape(intro)}</p>
+    <div class="table-wrap">
+    <table class="sortable">
+        <thead><tr>{header}</tr></thead>
+        <tbody>
+        {body}
+        </tbody>
+    </table>
+    </div>
+    <script>
+        // Sort the table by the clicked column; numeric cells carry their value in data-value.
+        document.querySelectorAll("table.sortable th").forEach(th => th.addEventListener("click", () => {{
+            const tbody = th.closest("table").tBodies[0];
+            const col = Number(th.dataset.col);
+            const asc = th.dataset.order !== "asc";
+            th.closest("tr").querySelectorAll("th").forEach(h => delete h.dataset.order);
+            th.dataset.order = asc ? "asc" : "desc";
+            const key = row => {{
+                const cell = row.cells[col];
+                return cell.dataset.value !== undefined ? Number(cell.dataset.value) : cell.textContent.toLowerCase();
+            }};
+            const rows = Array.from(tbody.rows);
+            rows.sort((a, b) => {{
+                const ka = key(a), kb = key(b);
+                if (typeof ka !== typeof kb) return typeof ka === "number" ? -1 : 1;
+                return (ka < kb ? -1 : ka > kb ? 1 : 0) * (asc ? 1 : -1);
+            }});
+            rows.forEach(row => tbody.appendChild(row));
+        }}));
+    </script>"""
+
+
+def render_compatibility_matrix(plugins: list[dict]) -> str:
+    """
+    Render the compatibility matrix: one row per Nsight Systems version declared as a plugin minimum,
+    newest first, followed by an "Any version" row, and one column per architecture and operating system
+    pair. Each cell lists the plugins usable with that version on that platform; the "Any version" row
+    lists the plugins that do not declare a minimal version.
+    """
+    platforms = [(arch, os) for arch in sorted(VALID_ARCHITECTURES) for os in sorted(VALID_OPERATING_SYSTEMS)]
+    versions = sorted({p["MinNsightSystemsVersion"] for p in plugins if p.get("MinNsightSystemsVersion")},
+                      key=parse_version, reverse=True)
+    header = "".join(f"<th>{escape(arch)} / {escape(os)}</th>" for arch, os in platforms)
+    rows = []
+    # None stands for the "Any version" row, which only plugins without a declared minimum satisfy.
+    for version in versions + [None]:
+        cells = []
+        for arch, os in platforms:
+            names = [
+                f'<a href="index.html#plugin-{i}">{escape(p["Name"])}</a>'
+                for i, p in enumerate(plugins)
+                if arch in p["Architectures"] and os in p["OperatingSystems"]
+                and (not p.get("MinNsightSystemsVersion")
+                     or version is not None and parse_version(p["MinNsightSystemsVersion"]) <= parse_version(version))
+            ]
+            cells.append(f"<td>{'<br />'.join(names) or '-'}</td>")
+        label = escape(version) if version is not None else "Any version"
+        rows.append(f"<tr><th>{label}</th>{''.join(cells)}</tr>")
+    body = "\n        ".join(rows)
+    return f"""<div class="table-wrap">
+    <table>
+        <thead><tr><th>Nsight Systems version</th>{header}</tr></thead>
+        <tbody>
+        {body}
+        </tbody>
+    </table>
+    </div>"""
+
+
+def render_page(title: str, content: str) -> str:
+    """Wrap content in the site's common page layout."""
+    return f"""<!DOCTYPE html>
+<html lang="en">
+<head>
+    <meta charset="UTF-8" />
+    <meta name="viewport" content="width=device-width, initial-scale=1" />
+    <title>{title}</title>
+    <link rel="icon" type="image/x-icon" href="./Images/nvidia-favicon.ico">
+    <style>
+        :root {{ font-family: system-ui, sans-serif; line-height: 1.5; color: #1a1a1a; background: #f5f5f5; }}
+        body {{ max-width: 720px; margin: 0 auto; padding: 1.5rem; }}
+        .page-header {{ display: flex; align-items: center; gap: 1rem; margin-bottom: 0.5rem; }}
+        .page-header img {{ height: 5rem; width: auto; display: block; margin-left: -1.5rem; }}
+        h1 {{ margin: 0; }}
+        .toc {{ background: #fff; border-radius: 8px; padding: 1rem 1.25rem; margin-bottom: 1.5rem; box-shadow: 0 1px 3px rgba(0,0,0,0.08); }}
+        .toc ul {{ margin: 0; padding-left: 1.5rem; }}
+        .toc li {{ margin: 0.35rem 0; }}
+        .toc a {{ color: #0066cc; text-decoration: none; }}
+        .toc a:hover {{ text-decoration: underline; }}
+        .plugin-card {{ background: #fff; border-radius: 8px; padding: 1.25rem; margin-bottom: 1.5rem; box-shadow: 0 1px 3px rgba(0,0,0,0.08); }}
+        .plugin-header {{ display: flex; align-items: flex-start; gap: 1rem; flex-wrap: wrap; }}
+        .plugin-header h2 {{ margin: 0 0 0.5rem 0; font-size: 1.25rem; }}
+        .plugin-thumb {{ flex-shrink: 0; }}
+        .plugin-thumb a {{ text-decoration: none; display: inline-block; }}
+        .plugin-img {{ max-width: 700px; max-height: 300px; object-fit: contain; border-radius: 4px; }}
+        .plugin-desc {{ margin: 0.5rem 0; color: #333; }}
+        .plugin-meta {{ margin: 0.75rem 0; font-size: 0.9rem; }}
+        .plugin-meta dt {{ font-weight: 600; margin-top: 0.25rem; }}
+        .plugin-meta dd {{ margin: 0 0 0 1rem; }}
+        .plugin-link {{ margin: 0.5rem 0 0 0; }}
+        .plugin-link a {{ color: #0066cc; }}
+        .bench-table {{ border-collapse: collapse; margin: 0.25rem 0; }}
+        .bench-table th, .bench-table td {{ text-align: left; padding: 0.15rem 0.75rem 0.15rem 0; white-space: nowrap; }}
+        .bench-table td {{ border-top: 1px solid #e0e0e0; }}
+        .bench-version {{ color: #666; }}
+        .sparkline {{ vertical-align: middle; }}
+        .table-wrap {{ background: #fff; border-radius: 8px; padding: 1rem 1.25rem; margin: 1rem 0 1.5rem 0; box-shadow: 0 1px 3px rgba(0,0,0,0.08); overflow-x: auto; }}
+        .table-wrap table {{ border-collapse: collapse; font-size: 0.9rem; }}
+        .table-wrap th, .table-wrap td {{ text-align: left; vertical-align: top; padding: 0.3rem 0.75rem 0.3rem 0; border-top: 1px solid #e0e0e0; }}
+        .table-wrap a {{ color: #0066cc; }}
+        table.sortable th {{ cursor: pointer; white-space: nowrap; }}
+        table.sortable th[data-order="asc"]::after {{ content: " \\25B2"; }}
+        table.sortable th[data-order="desc"]::after {{ content: " \\25BC"; }}
+    </style>
+</head>
+<body>
+    <header class="page-header">
+        <img src="./Images/nvidia-logo-horiz-rgb-blk-for-screen.svg" alt="NVIDIA" />
+    </header>
+    <h1>{title}</h1>
+{content}
+</body>
+</html>
+"""
+
+
+def build_html(plugins: list[dict], benchmarks: dict[str, dict], output_file_path: Path) -> None:
+    """
+    Generate an HTML page listing all plugins and write it to output_file_path.
+    The overhead comparison and compatibility matrix pages are written next to it.
+    """
     title = "Nsight Systems Plugins"
     toc_rows = []
     body_rows = []
@@ -140,6 +572,7 @@ def build_html(plugins: list[dict], output_file_path: Path) -> None:
                 path_esc = escape(path)
                 img_html = f'<a href="{path_esc}"><img src="{path_esc}" alt="{alt}" class="plugin-img" /></a>'
         site_link = f'<a href="{site_esc}" rel="noopener noreferrer">{site_esc}</a>' if site_url else ""
+        bench_html = benchmarks.get(p.get("Name"), {}).get("Html", "")
         body_rows.append(
             f"""
         <article class="plugin-card" id="{anchor_id}">
@@ -155,52 +588,17 @@ def build_html(plugins: list[dict], output_file_path: Path) -> None:
                 {f'<dt>Setup Notes</dt><dd>{setup_notes}</dd>' if setup_notes else ''}
                 <dt>Site URL</dt><dd>{f'<p class="plugin-link">{site_link}</p>' if site_link else ''}</dd>
                 <dt>Company</dt><dd>{company}</dd>
+                {f'<dt>Benchmarks</dt><dd>{bench_html}</dd>' if bench_html else ''}
             </dl>
         </article>"""
         )
     toc = "\n".join(toc_rows)
     body = "\n".join(body_rows)
-    html = f"""<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8" />
-    <meta name="viewport" content="width=device-width, initial-scale=1" />
-    <title>{title}</title>
-    <link rel="icon" type="image/x-icon" href="./Images/nvidia-favicon.ico">
-    <style>
-        :root {{ font-family: system-ui, sans-serif; line-height: 1.5; color: #1a1a1a; background: #f5f5f5; }}
-        body {{ max-width: 720px; margin: 0 auto; padding: 1.5rem; }}
-        .page-header {{ display: flex; align-items: center; gap: 1rem; margin-bottom: 0.5rem; }}
-        .page-header img {{ height: 5rem; width: auto; display: block; margin-left: -1.5rem; }}
-        h1 {{ margin: 0; }}
-        .toc {{ background: #fff; border-radius: 8px; padding: 1rem 1.25rem; margin-bottom: 1.5rem; box-shadow: 0 1px 3px rgba(0,0,0,0.08); }}
-        .toc ul {{ margin: 0; padding-left: 1.5rem; }}
-        .toc li {{ margin: 0.35rem 0; }}
-        .toc a {{ color: #0066cc; text-decoration: none; }}
-        .toc a:hover {{ text-decoration: underline; }}
-        .plugin-card {{ background: #fff; border-radius: 8px; padding: 1.25rem; margin-bottom: 1.5rem; box-shadow: 0 1px 3px rgba(0,0,0,0.08); }}
-        .plugin-header {{ display: flex; align-items: flex-start; gap: 1rem; flex-wrap: wrap; }}
-        .plugin-header h2 {{ margin: 0 0 0.5rem 0; font-size: 1.25rem; }}
-        .plugin-thumb {{ flex-shrink: 0; }}
-        .plugin-thumb a {{ text-decoration: none; display: inline-block; }}
-        .plugin-img {{ max-width: 700px; max-height: 300px; object-fit: contain; border-radius: 4px; }}
-        .plugin-desc {{ margin: 0.5rem 0; color: #333; }}
-        .plugin-meta {{ margin: 0.75rem 0; font-size: 0.9rem; }}
-        .plugin-meta dt {{ font-weight: 600; margin-top: 0.25rem; }}
-        .plugin-meta dd {{ margin: 0 0 0 1rem; }}
-        .plugin-link {{ margin: 0.5rem 0 0 0; }}
-        .plugin-link a {{ color: #0066cc; }}
-    </style>
-</head>
-<body>
-    <header class="page-header">
-        <img src="./Images/nvidia-logo-horiz-rgb-blk-for-screen.svg" alt="NVIDIA" />
-    </header>
-    <h1>{title}</h1>
-    <p>This site lists Nsight Systems third-party plugins.<p>
+    html = render_page(title, f"""    <p>This site lists Nsight Systems third-party plugins.<p>
     <ul>
         <li>For information about Nsight Systems, visit the <a href="https://developer.nvidia.com/nsight-systems" target="_blank" rel="noopener noreferrer">Nsight Systems website</a>.</li>
         <li>To add a third-party plugin to this list, refer to the instructions provided in the <a href="https://github.com/NVIDIA/NsightSystemsPlugins/blob/main/ADD_PLUGIN.md" target="_blank" rel="noopener noreferrer">ADD_PLUGIN.md file.</a> file.</li>
+        <li>To choose between plugins, see the <a href="{OVERHEAD_PAGE}">overhead comparison</a> and the <a href="{COMPATIBILITY_PAGE}">compatibility matrix</a>.</li>
     </ul>
     <nav class="toc" aria-label="Plugin list">
     <p><b>Table of Contents</b></p>
@@ -216,12 +614,46 @@ def build_html(plugins: list[dict], output_file_path: Path) -> None:
     <p>Third-party plugins may contain errors, security vulnerabilities, or functionality that is inaccurate, incomplete, or otherwise undesirable. By downloading or using any plugin, you acknowledge and agree that you do so at your own risk. We disclaim all responsibility and liability for any harm, damage, or loss arising from the use of these plugins.</p>
     <p>Use of any plugin is subject to the applicable third-party license terms, and you are solely responsible for complying with those terms.</p>
     <p>We do not provide support, updates, or security fixes for these plugins.</p>
-</article>
-</body>
-</html>
-"""
-    output_file_path.parent.mkdir(parents=True, exist_ok=True)
+</article>""")
+
+    overhead_html = render_page("Plugin Overhead Comparison", f"""    <p><a href="index.html">Back to the plugins list</a></p>
+    {render_overhead_table(plugins, benchmarks)}""")
+
+    compatibility_html = render_page("Plugin Compatibility Matrix", f"""    <p><a href="index.html">Back to the plugins list</a></p>
+    <p>Plugins available on each architecture and operating system, for each minimal Nsight Systems version required by a listed plugin. The "Any version" row lists the plugins that do not declare a minimal version.</p>
+    {render_compatibility_matrix(plugins)}""")
+
+    output_dir = output_file_path.parent
+    output_dir.mkdir(parents=True, exist_ok=True)
     output_file_path.write_text(html, encoding="utf-8")
+    (output_dir / OVERHEAD_PAGE).write_text(overhead_html, encoding="utf-8")
+    (output_dir / COMPATIBILITY_PAGE).write_text(compatibility_html, encoding="utf-8")
+
+
+def build_catalog(plugins: list[dict], output_file_path: Path) -> None:
+    """Write the range-request friendly binary catalog of plugins to output_file_path, see PluginCatalog.py."""
+    by_name = {}
+    for p in plugins:
+        name = p["Name"].encode("utf-8")
+        if name in by_name:
+            print(f"Warning: duplicate plugin name {p['Name']!r} is omitted from {CATALOG_FILE}", file=sys.stderr)
+            continue
+        by_name[name] = json.dumps(p, ensure_ascii=False, separators=(",", ":")).encode("utf-8")
+
+    entries = bytearray()
+    names = bytearray()
+    records = bytearray()
+    for name in sorted(by_name):
+        record = by_name[name]
+        entries += CATALOG_INDEX_ENTRY.pack(len(names), len(name), len(records), len(record))
+        names += name
+        records += record
+
+    index_size = len(entries) + len(names)
+    header = CATALOG_HEADER.pack(CATALOG_MAGIC, CATALOG_VERSION, len(by_name), index_size,
+                                 CATALOG_HEADER.size + index_size)
+    output_file_path.parent.mkdir(parents=True, exist_ok=True)
+    output_file_path.write_bytes(header + entries + names + records)
 
 
 def main() -> int:
@@ -240,6 +672,13 @@ def main() -> int:
         type=Path,
         help="The output HTML file path",
     )
+    parser.add_argument(
+        "-c",
+        "--cache-dir",
+        default=None,
+        type=Path,
+        help="Optional directory, dedicated to this cache, for caching rendered benchmark results between runs",
+    )
    
     args = parser.parse_args()
     input_dir = args.input_dir.resolve()
@@ -257,7 +696,14 @@ def main() -> int:
         print("No plugin JSON files found.", file=sys.stderr)
         return 1
     
-    build_html(plugins, output_file_path)
+    cache_dir = args.cache_dir.resolve() if args.cache_dir is not None else None
+    benchmarks = collect_benchmarks(input_dir, cache_dir)
+    plugin_names = {p["Name"] for p in plugins}
+    for name in sorted(benchmarks.keys() - plugin_names):
+        print(f"Warning: benchmark results for unknown plugin {name!r} are ignored", file=sys.stderr)
+
+    build_html(plugins, benchmarks, output_file_path)
+    build_catalog(plugins, output_file_path.parent / CATALOG_FILE)
     print(f"Wrote {output_file_path} ({len(plugins)} plugin(s))")
     
     return 0
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Reference client for the binary plugin catalog (catalog.bin) generated by BuildHTMLFromJSONFiles.py.
+Fetches a single plugin's JSON record using HTTP range requests, without downloading the whole catalog.
+The catalog layout is described in PluginCatalog.py.
+"""
+
+import sys
+import argparse
+import bisect
+import json
+import re
+import urllib.request
+
+from PluginCatalog import CATALOG_HEADER, CATALOG_INDEX_ENTRY, CATALOG_MAGIC, CATALOG_VERSION
+
+
+DEFAULT_INITIAL_BYTES = 64 * 1024
+
+
+class RangeReader:
+    """Reads byte ranges of a URL and accounts for the transferred bytes."""
+
+    def __init__(self, url: str):
+        self.url = url
+        self.requests = 0
+        self.bytes_transferred = 0
+
+    def read(self, offset: int, size: int) -> bytes:
+        """Read up to size bytes at offset. Fewer bytes are returned at the end of the file."""
+        request = urllib.request.Request(self.url, headers={"Range": f"bytes={offset}-{offset + size - 1}"})
+        with urllib.request.urlopen(request) as response:
+            data = response.read()
+            status = response.status
+            content_range = response.headers.get("Content-Range", "")
+        self.requests += 1
+        self.bytes_transferred += len(data)
+        if status == 200:
+            # The server ignored the range and sent the whole file.
+            return data[offset:offset + size]
+        if status != 206:
+            raise OSError(f"unexpected HTTP status {status} for {self.url}")
+        # A proxy may answer with a different or coalesced range; never parse bytes from elsewhere in the file.
+        match = re.fullmatch(r"bytes (\d+)-(\d+)/(\d+|\*)", content_range.strip())
+        if match is None:
+            raise OSError(f"missing or unsupported Content-Range {content_range!r} for {self.url}")
+        first, last = int(match[1]), int(match[2])
+        if first != offset or last >= offset + size or len(data) != last - first + 1:
+            raise OSError(f"Content-Range {content_range!r} does not match the requested "
+                          f"bytes {offset}-{offset + size - 1} of {self.url}")
+        return data
+
+
+class CatalogIndex:
+    """The decoded sorted name index of a catalog."""
+
+    def __init__(self, index: bytes, count: int):
+        entries_size = count * CATALOG_INDEX_ENTRY.size
+        self.entries = list(CATALOG_INDEX_ENTRY.iter_unpack(index[:entries_size]))
+        self.names = index[entries_size:]
+
+    def name(self, i: int) -> bytes:
+        name_offset, name_length, _, _ = self.entries[i]
+        return self.names[name_offset:name_offset + name_length]
+
+    def __len__(self) -> int:
+        return len(self.entries)
+
+    def __getitem__(self, i: int) -> bytes:
+        return self.name(i)
+
+    def find(self, name: str) -> tuple[int, int] | None:
+        """Return the (offset, length) of the named plugin's record, relative to the records offset."""
+        key = name.encode("utf-8")
+        i = bisect.bisect_left(self, key)
+        if i == len(self) or self.name(i) != key:
+            return None
+        _, _, record_offset, record_length = self.entries[i]
+        return record_offset, record_length
+
+
+def fetch_plugin_record(reader: RangeReader, name: str, initial_bytes: int = DEFAULT_INITIAL_BYTES) -> dict | None:
+    """
+    Fetch the named plugin's record. The first request reads initial_bytes, which covers the header and
+    the index of small catalogs, and possibly the record itself; the rest of a larger index is read
+    with one more request.
+    """
+    head = reader.read(0, max(initial_bytes, CATALOG_HEADER.size))
+    if len(head) < CATALOG_HEADER.size:
+        raise ValueError("truncated catalog header")
+    magic, version, count, index_size, records_offset = CATALOG_HEADER.unpack_from(head)
+    if magic != CATALOG_MAGIC or version != CATALOG_VERSION:
+        raise ValueError(f"not a version {CATALOG_VERSION} plugin catalog")
+
+    index = head[CATALOG_HEADER.size:CATALOG_HEADER.size + index_size]
+    if len(index) < index_size:
+        index += reader.read(CATALOG_HEADER.size + len(index), index_size - len(index))
+    if len(index) != index_size:
+        raise ValueError("truncated catalog index")
+
+    location = CatalogIndex(index, count).find(name)
+    if location is None:
+        return None
+    record_offset, record_length = location
+    record_start = records_offset + record_offset
+    if record_start + record_length <= len(head):
+        record = head[record_start:record_start + record_length]
+    else:
+        record = reader.read(record_start, record_length)
+    if len(record) != record_length:
+        raise ValueError("truncated catalog record")
+    return json.loads(record)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Fetch one plugin record from a binary Nsight Systems plugin catalog.")
+    parser.add_argument("url", help="URL of the catalog.bin file")
+    parser.add_argument("name", help="Name of the plugin to fetch")
+    parser.add_argument(
+        "--initial-bytes",
+        default=DEFAULT_INITIAL_BYTES,
+        type=int,
+        help="Size of the first range request, which should cover the catalog header and index",
+    )
+    parser.add_argument("-v", "--verbose", action="store_true", help="Report the requests and bytes transferred")
+
+    args = parser.parse_args()
+    reader = RangeReader(args.url)
+    try:
+        record = fetch_plugin_record(reader, args.name, args.initial_bytes)
+    except (OSError, ValueError) as e:
+        print(f"Error: failed to read {args.url}: {e}", file=sys.stderr)
+        return 1
+    if args.verbose:
+        print(f"{reader.requests} request(s), {reader.bytes_transferred} byte(s) transferred", file=sys.stderr)
+    if record is None:
+        print(f"Error: plugin {args.name!r} not found", file=sys.stderr)
+        return 1
+
+    print(json.dumps(record, indent=4, ensure_ascii=False))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,23 @@
+"""
+Layout of the binary plugin catalog (catalog.bin), shared by its writer in BuildHTMLFromJSONFiles.py
+and its reference client in FetchPluginRecord.py.
+
+The catalog holds all plugin records, laid out for lookups through HTTP range requests.
+All integers are little-endian:
+  header:  magic, format version, record count, index size in bytes, records offset
+  index:   one fixed-size entry per plugin, sorted by UTF-8 name:
+           name offset (into the names blob), name length, record offset (from records offset), record length
+           followed by the names blob
+  records: the plugins' JSON descriptors, compact UTF-8, in index order
+A client reads the header and index with one range request, bisects the entries by name,
+and reads one record with a second range request, unless the first request already covered it.
+"""
+
+import struct
+
+
+CATALOG_FILE = "catalog.bin"
+CATALOG_MAGIC = b"NSYSPCAT"
+CATALOG_VERSION = 1
+CATALOG_HEADER = struct.Struct("<8sIIQQ")
+CATALOG_INDEX_ENTRY = struct.Struct("<IIQI")